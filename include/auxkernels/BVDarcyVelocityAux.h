@@ -28,5 +28,9 @@ protected:
   const unsigned int _component;
   const MooseArray<Point> & _normals;
   const ADVariableGradient & _grad_pf;
+  const RealVectorValue _gravity;
+  const bool _has_gravity;
   const ADMaterialProperty<Real> & _lambda;
+  // Fluid density, only required with gravity
+  const ADMaterialProperty<Real> * _rho;
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "FVFluxKernel.h"
+#include "BVFVFaceCache.h"
 
 class BVFVFluxKernelBase : public FVFluxKernel
 {
@@ -21,13 +22,68 @@ public:
   static InputParameters validParams();
   BVFVFluxKernelBase(const InputParameters & params);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual ADReal transmissibility(const ADReal & coeff_elem, const ADReal & coeff_neighbor) const;
   virtual ADRealVectorValue diffusiveFlux(const ADReal & mobility_elem,
                                           const ADReal & mobility_neighbor,
                                           const MooseVariableFV<Real> & fv_var) const;
-  virtual ADRealVectorValue advectiveFluxVariable(const ADRealVectorValue & vel) const;
+  // Darcy velocity of a pressure variable, shared through the face cache if provided
+  ADRealVectorValue darcyVelocity(const ADReal & mobility_elem,
+                                  const ADReal & mobility_neighbor,
+                                  const MooseVariableFV<Real> & p_var) const;
+  // Darcy velocity including the gravity term weighted by the mobility times density
+  virtual ADRealVectorValue darcyVelocity(const ADReal & mobility_elem,
+                                          const ADReal & mobility_neighbor,
+                                          const MooseVariableFV<Real> & p_var,
+                                          const ADReal & gravity_coeff_elem,
+                                          const ADReal & gravity_coeff_neighbor) const;
+  // Gravity vector seen by the face: g, or the elevation difference g.d_CN along the normal for
+  // the two-point flux approximation
+  RealVectorValue faceGravity() const;
+  // Darcy velocity evaluating the mobility functor only if not found in the face cache
+  virtual ADRealVectorValue darcyVelocity(const Moose::Functor<ADReal> & mobility,
+                                          const MooseVariableFV<Real> & p_var) const;
+  ADRealVectorValue advectiveFluxVariable(const ADRealVectorValue & vel) const;
+  virtual ADRealVectorValue advectiveFluxVariable(const ADRealVectorValue & vel,
+                                                  const MooseVariableFV<Real> & fv_var) const;
   virtual ADRealVectorValue advectiveFluxMaterial(const ADReal & qty_elem,
                                                   const ADReal & qty_neighbor,
                                                   const ADRealVectorValue & vel) const;
+  // Advective flux evaluating the functor on the upwind element only for first order upwinding
+  virtual ADRealVectorValue advectiveFluxFunctor(const Moose::Functor<ADReal> & qty,
+                                                 const ADRealVectorValue & vel) const;
+  // Values of a functor on both sides of the face, the element value is used on boundaries
+  std::pair<ADReal, ADReal> faceValues(const Moose::Functor<ADReal> & qty) const;
+  // Weight of the downwind minus upwind difference in the limited reconstruction at the face
+  ADReal limitedWeight(const bool elem_is_upwind) const;
+  virtual ADReal limitedWeight(const bool elem_is_upwind,
+                               const MooseVariableFV<Real> & fv_var) const;
+  virtual ADReal limiter(const ADReal & r) const;
+  // Ratio of the normal permeability n.K.n to the scalar permeability averaged over the face,
+  // applied to the normal transmissibility of the pressure gradient term only
+  virtual Real permeabilityFaceFactor() const;
+
+  // Face cache and identifier of the Darcy velocity in the cache
+  const BVFVFaceCache * _face_cache;
+  const unsigned int _face_cache_id;
+
+  // Two-point flux approximation of the normal gradients on internal faces
+  const bool _tpfa;
+  const Real _orthogonality_tolerance;
+
+  // Gravity
+  const RealVectorValue _gravity;
+  const bool _has_gravity;
+
+  // Anisotropic permeability
+  const bool _anisotropic_permeability;
+  const MaterialProperty<RealTensorValue> * _K;
+  const MaterialProperty<RealTensorValue> * _K_neighbor;
+  const ADMaterialProperty<Real> * _k;
+  const ADMaterialProperty<Real> * _k_neighbor;
+
+  // Interpolation of the advected quantities
+  const enum class AdvectedInterpEnum { UPWIND, MINMOD, VANLEER, SUPERBEE } _advected_interp;
 };
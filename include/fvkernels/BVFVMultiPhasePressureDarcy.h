@@ -24,6 +24,20 @@ public:
 protected:
   virtual ADReal computeQpResidual() override;
 
-  const ADMaterialProperty<Real> & _lambda;
-  const ADMaterialProperty<Real> & _lambda_neighbor;
+  // Evaluate the mobility as a functor, only when needed
+  const bool _lazy_properties;
+
+  const ADMaterialProperty<Real> * _lambda;
+  const ADMaterialProperty<Real> * _lambda_neighbor;
+  const Moose::Functor<ADReal> * _lambda_functor;
+
+  // Fractional flows and phase densities, only required with gravity
+  const ADMaterialProperty<Real> * _f_w;
+  const ADMaterialProperty<Real> * _f_w_neighbor;
+  const ADMaterialProperty<Real> * _f_n;
+  const ADMaterialProperty<Real> * _f_n_neighbor;
+  const ADMaterialProperty<Real> * _rho_w;
+  const ADMaterialProperty<Real> * _rho_w_neighbor;
+  const ADMaterialProperty<Real> * _rho_n;
+  const ADMaterialProperty<Real> * _rho_n_neighbor;
 };
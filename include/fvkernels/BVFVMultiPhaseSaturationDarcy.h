@@ -27,12 +27,26 @@ protected:
   const enum class PhaseEnum { WETTING, NON_WETTING, SINGLE } _phase;
 
   const MooseVariableFV<Real> * _p_var;
-  const ADMaterialProperty<Real> & _lambda;
-  const ADMaterialProperty<Real> & _lambda_neighbor;
-  const ADMaterialProperty<Real> & _f_w;
-  const ADMaterialProperty<Real> & _f_w_neighbor;
-  const ADMaterialProperty<Real> & _f_n;
-  const ADMaterialProperty<Real> & _f_n_neighbor;
-  const ADMaterialProperty<Real> & _D;
-  const ADMaterialProperty<Real> & _D_neighbor;
+  // Evaluate the flow properties as functors, only when needed
+  const bool _lazy_properties;
+
+  const ADMaterialProperty<Real> * _lambda;
+  const ADMaterialProperty<Real> * _lambda_neighbor;
+  const ADMaterialProperty<Real> * _f_w;
+  const ADMaterialProperty<Real> * _f_w_neighbor;
+  const ADMaterialProperty<Real> * _f_n;
+  const ADMaterialProperty<Real> * _f_n_neighbor;
+  const ADMaterialProperty<Real> * _D;
+  const ADMaterialProperty<Real> * _D_neighbor;
+
+  // Phase densities, only required with gravity
+  const ADMaterialProperty<Real> * _rho_w;
+  const ADMaterialProperty<Real> * _rho_w_neighbor;
+  const ADMaterialProperty<Real> * _rho_n;
+  const ADMaterialProperty<Real> * _rho_n_neighbor;
+
+  // Functor properties
+  const Moose::Functor<ADReal> * _lambda_functor;
+  const Moose::Functor<ADReal> * _f_functor;
+  const Moose::Functor<ADReal> * _D_functor;
 };
@@ -26,4 +26,8 @@ protected:
 
   const ADMaterialProperty<Real> & _lambda;
   const ADMaterialProperty<Real> & _lambda_neighbor;
+
+  // Fluid density, only required with gravity
+  const ADMaterialProperty<Real> * _rho;
+  const ADMaterialProperty<Real> * _rho_neighbor;
 };
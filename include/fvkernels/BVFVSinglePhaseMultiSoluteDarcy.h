@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVFVFluxKernelBase.h"
+
+/**
+ * Advection-dispersion of several solute species in a single phase flow. The Darcy velocity and
+ * the dispersion transmissibility are computed once per face and applied to all species, the
+ * residuals being added to the kernel variable and to each of the coupled species.
+ */
+class BVFVSinglePhaseMultiSoluteDarcy : public BVFVFluxKernelBase
+{
+public:
+  static InputParameters validParams();
+  BVFVSinglePhaseMultiSoluteDarcy(const InputParameters & parameters);
+
+  virtual void computeResidual(const FaceInfo & fi) override;
+  virtual void computeJacobian(const FaceInfo & fi) override;
+  virtual void computeResidualAndJacobian(const FaceInfo & fi) override;
+
+protected:
+  virtual ADReal computeQpResidual() override;
+  // Residuals of all species on the current face (without the face area)
+  virtual std::vector<ADReal> computeSpeciesResiduals();
+  // Darcy velocity shared by all species
+  ADRealVectorValue sharedDarcyVelocity() const;
+  // Residual of one species given the face Darcy velocity
+  ADReal speciesResidual(const MooseVariableFV<Real> & species, const ADRealVectorValue & u) const;
+
+  const MooseVariableFV<Real> * _p_var;
+  const ADMaterialProperty<Real> & _lambda;
+  const ADMaterialProperty<Real> & _lambda_neighbor;
+  const ADMaterialProperty<Real> & _lambda_c;
+  const ADMaterialProperty<Real> & _lambda_c_neighbor;
+
+  // Fluid density, only required with gravity
+  const ADMaterialProperty<Real> * _rho;
+  const ADMaterialProperty<Real> * _rho_neighbor;
+
+  // The kernel variable followed by the coupled species
+  std::vector<const MooseVariableFV<Real> *> _species;
+};
\ No newline at end of file
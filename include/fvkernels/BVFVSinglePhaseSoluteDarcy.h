@@ -29,4 +29,8 @@ protected:
   const ADMaterialProperty<Real> & _lambda_neighbor;
   const ADMaterialProperty<Real> & _lambda_c;
   const ADMaterialProperty<Real> & _lambda_c_neighbor;
+
+  // Fluid density, only required with gravity
+  const ADMaterialProperty<Real> * _rho;
+  const ADMaterialProperty<Real> * _rho_neighbor;
 };
@@ -24,5 +24,9 @@ public:
 protected:
   virtual ADRealVectorValue precomputeQpResidual() override;
 
+  const RealVectorValue _gravity;
+  const bool _has_gravity;
   const ADMaterialProperty<Real> & _lambda;
+  // Fluid density, only required with gravity
+  const ADMaterialProperty<Real> * _rho;
 };
\ No newline at end of file
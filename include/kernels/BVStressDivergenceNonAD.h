@@ -0,0 +1,42 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Kernel.h"
+
+class BVStressDivergenceNonAD : public Kernel
+{
+public:
+  static InputParameters validParams();
+  BVStressDivergenceNonAD(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual Real stressJacobian(const unsigned int k);
+
+  const bool _coupled_pf;
+  const VariableValue & _pf;
+  const unsigned int _pf_var;
+  const unsigned int _component;
+  const Real _rho;
+  const RealVectorValue _gravity;
+  const unsigned int _ndisp;
+  std::vector<unsigned int> _disp_var;
+
+  const ADMaterialProperty<RankTwoTensor> & _stress;
+  const MaterialProperty<RankFourTensor> & _tangent;
+  const ADMaterialProperty<Real> * _biot;
+};
\ No newline at end of file
@@ -13,9 +13,9 @@
 
 #pragma once
 
-#include "BVTwoCreepUpdateBase.h"
+#include "BVMultiCreepUpdateBase.h"
 
-class BVBlancoMartinModelUpdate : public BVTwoCreepUpdateBase
+class BVBlancoMartinModelUpdate : public BVMultiCreepUpdateBase<2>
 {
 public:
   static InputParameters validParams();
@@ -23,23 +23,20 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
-  virtual ADReal creepRate(const std::vector<ADReal> & eqv_strain_incr,
+  virtual void preCreepRate(const std::array<ADReal, 2> & eqv_strain_incr) override;
+  virtual ADReal creepRate(const std::array<ADReal, 2> & eqv_strain_incr,
                            const unsigned int i) override;
-  virtual ADReal creepRateR(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateLemaitre(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateMunsonDawson(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal creepRateLemaitre();
+  virtual ADReal creepRateMunsonDawson();
+  virtual ADReal creepRateDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                      const unsigned int i,
                                      const unsigned int j) override;
-  virtual ADReal creepRateRDerivative(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateLemaitreDerivative(const std::vector<ADReal> & eqv_strain_incr,
-                                             const unsigned int /*j*/);
-  virtual ADReal creepRateMunsonDawsonDerivative(const std::vector<ADReal> & eqv_strain_incr,
-                                                 const unsigned int j);
-  virtual ADReal lemaitreCreepStrain(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal munsondawsonCreepStrain(const std::vector<ADReal> & eqv_strain_incr);
-  virtual void preReturnMap() override;
-  virtual void postReturnMap(const std::vector<ADReal> & eqv_strain_incr) override;
+  virtual ADReal creepRateLemaitreDerivative(const unsigned int j);
+  virtual ADReal creepRateMunsonDawsonDerivative(const unsigned int j);
+  virtual ADReal lemaitreCreepStrain(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal munsondawsonCreepStrain(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual void resetQpInternalVariables() override;
+  virtual void postReturnMap(const std::array<ADReal, 2> & eqv_strain_incr) override;
 
   // Lemaitre creep strain rate parameters
   const Real _alpha;
@@ -47,6 +44,9 @@ protected:
   const Real _kr2;
   const Real _beta1;
   const Real _beta2;
+  const Real _inv_alpha;
+  const Real _inv_kr1;
+  const Real _inv_kr2;
 
   // Munson-Dawson creep strain rate parameters
   const Real _A1;
@@ -55,6 +55,16 @@ protected:
   const Real _B;
   const Real _m;
   const Real _n;
+  const Real _inv_A1;
+
+  // Terms shared by the creep rates and their derivatives
+  ADReal _rate_R;
+  ADReal _rate_R_deriv;
+  ADReal _gamma_l;
+  ADReal _gamma_l_pow;
+  ADReal _saturation_strain;
+  ADReal _gamma_ms_ratio;
+  ADReal _gamma_ms_pow;
 
   // Internal variable for Lemaitre and Munson-Dawson creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain_L;
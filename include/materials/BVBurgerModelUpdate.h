@@ -13,9 +13,9 @@
 
 #pragma once
 
-#include "BVTwoCreepUpdateBase.h"
+#include "BVMultiCreepUpdateBase.h"
 
-class BVBurgerModelUpdate : public BVTwoCreepUpdateBase
+class BVBurgerModelUpdate : public BVMultiCreepUpdateBase<2>
 {
 public:
   static InputParameters validParams();
@@ -23,29 +23,29 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
-  virtual ADReal creepRate(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal creepRate(const std::array<ADReal, 2> & eqv_strain_incr,
                            const unsigned int i) override;
-  virtual ADReal creepRateMaxwell(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateKelvin(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal creepRateDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal creepRateMaxwell(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal creepRateKelvin(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal creepRateDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                      const unsigned int i,
                                      const unsigned int j) override;
-  virtual ADReal creepRateMaxwellDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal creepRateMaxwellDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                             const unsigned int /*j*/);
-  virtual ADReal creepRateKelvinDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal creepRateKelvinDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                            const unsigned int j);
-  virtual ADReal viscosityMaxwell(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal viscosityKelvin(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal viscosityMaxwellDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal viscosityMaxwell(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal viscosityKelvin(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal viscosityMaxwellDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                             const unsigned int j);
-  virtual ADReal viscosityKelvinDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal viscosityKelvinDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                            const unsigned int j);
-  virtual ADReal shearModulusKelvin(const std::vector<ADReal> & eqv_strain_incr);
-  virtual ADReal shearModulusKelvinDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal shearModulusKelvin(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual ADReal shearModulusKelvinDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                               const unsigned int j);
-  virtual ADReal kelvinCreepStrain(const std::vector<ADReal> & eqv_strain_incr);
-  virtual void preReturnMap() override;
-  virtual void postReturnMap(const std::vector<ADReal> & eqv_strain_incr) override;
+  virtual ADReal kelvinCreepStrain(const std::array<ADReal, 2> & eqv_strain_incr);
+  virtual void resetQpInternalVariables() override;
+  virtual void postReturnMap(const std::array<ADReal, 2> & eqv_strain_incr) override;
 
   // Maxwell viscosity
   const Real _etaM0;
@@ -11,37 +11,29 @@
 /*                 or http://www.gnu.org/licenses/lgpl.html                   */
 /******************************************************************************/
 
+
 #pragma once
 
-#include "BVInelasticUpdateBase.h"
+#include "BVMultiCreepUpdateBase.h"
 
-class BVCreepUpdateBase : public BVInelasticUpdateBase
+class BVCreepUpdateBase : public BVMultiCreepUpdateBase<1>
 {
 public:
   static InputParameters validParams();
   BVCreepUpdateBase(const InputParameters & parameters);
-  virtual void inelasticUpdate(ADRankTwoTensor & stress, const RankFourTensor & Cijkl) override;
 
 protected:
-  virtual ADReal returnMap();
-  virtual ADReal residual(const ADReal & creep_strain_incr);
-  virtual ADReal jacobian(const ADReal & creep_strain_incr);
-  virtual ADRankTwoTensor reformPlasticStrainTensor(const ADReal & creep_strain_incr);
-  virtual ADReal creepRate(const ADReal & creep_strain_incr) = 0;
-  virtual ADReal creepRateDerivative(const ADReal & creep_strain_incr) = 0;
-  virtual void preReturnMap();
-  virtual void postReturnMap(const ADReal & creep_strain_incr);
-
-  // Name used as a prefix for all material properties related to this creep model
-  const std::string _base_name;
-
-  // Creep strain increment
-  ADMaterialProperty<RankTwoTensor> & _creep_strain_incr;
-
-  // Trial stress tensor and scalar effective stress
-  ADRankTwoTensor _stress_tr;
-  ADReal _eqv_stress_tr;
-
-  // Shear modulus
-  Real _G;
-};
\ No newline at end of file
+  // Single mechanism interface of the coupled return map
+  virtual void preCreepRate(const std::array<ADReal, 1> & creep_strain_incr) override final;
+  virtual ADReal creepRate(const std::array<ADReal, 1> & creep_strain_incr,
+                           const unsigned int i) override final;
+  virtual ADReal creepRateDerivative(const std::array<ADReal, 1> & creep_strain_incr,
+                                     const unsigned int i,
+                                     const unsigned int j) override final;
+  virtual void postReturnMap(const std::array<ADReal, 1> & creep_strain_incr) override final;
+
+  virtual void preEqvCreepRate(const ADReal & eqv_strain_incr);
+  virtual ADReal eqvCreepRate(const ADReal & eqv_strain_incr) = 0;
+  virtual ADReal eqvCreepRateDerivative(const ADReal & eqv_strain_incr) = 0;
+  virtual void postEqvReturnMap(const ADReal & eqv_strain_incr);
+};
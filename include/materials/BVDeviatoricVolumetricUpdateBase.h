@@ -11,24 +11,39 @@
 /*                 or http://www.gnu.org/licenses/lgpl.html                   */
 /******************************************************************************/
 
+
 #pragma once
 
-#include "BVTwoCreepUpdateBase.h"
+#include "BVMultiCreepUpdateBase.h"
 
-class BVDeviatoricVolumetricUpdateBase : public BVTwoCreepUpdateBase
+class BVDeviatoricVolumetricUpdateBase : public BVMultiCreepUpdateBase<3>
 {
 public:
   static InputParameters validParams();
   BVDeviatoricVolumetricUpdateBase(const InputParameters & parameters);
 
 protected:
-  virtual std::vector<ADReal> returnMap() override;
-  virtual void preReturnMapVol(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal residualVol(const ADReal & vol_strain_incr);
-  virtual ADReal jacobianVol(const ADReal & vol_strain_incr);
-  virtual ADReal creepRateVol(const ADReal & vol_strain_incr);
-  virtual ADReal creepRateVolDerivative(const ADReal & vol_strain_incr);
-  virtual ADRankTwoTensor reformPlasticStrainTensor(const std::vector<ADReal> & creep_strain_incr) override;
-  
-  bool _volumetric;
-};
\ No newline at end of file
+  // Without volumetric correction, only the deviatoric increments are iterated on
+  virtual std::array<ADReal, 3> returnMap() override;
+  // Two deviatoric mechanisms (0, 1) coupled to a volumetric one (2)
+  virtual ADReal creepRate(const std::array<ADReal, 3> & creep_strain_incr,
+                           const unsigned int i) override final;
+  virtual ADReal creepRateDerivative(const std::array<ADReal, 3> & creep_strain_incr,
+                                     const unsigned int i,
+                                     const unsigned int j) override final;
+  virtual ADReal creepRateDev(const std::array<ADReal, 3> & creep_strain_incr,
+                              const unsigned int i) = 0;
+  virtual ADReal creepRateDevDerivative(const std::array<ADReal, 3> & creep_strain_incr,
+                                        const unsigned int i,
+                                        const unsigned int j) = 0;
+  virtual ADReal creepRateVol(const std::array<ADReal, 3> & creep_strain_incr);
+  virtual ADReal creepRateVolDerivative(const std::array<ADReal, 3> & creep_strain_incr,
+                                        const unsigned int j);
+  virtual ADRankTwoTensor
+  reformPlasticStrainTensor(const std::array<ADReal, 3> & creep_strain_incr) override;
+  virtual RankFourTensor creepStrainTangent(const std::array<Real, 3> & creep_strain_incr,
+                                            const std::array<Real, 3> & dincr_dq,
+                                            const std::array<Real, 3> & dincr_dp) override;
+
+  const bool _volumetric;
+};
@@ -16,16 +16,30 @@
 #include "Material.h"
 #include "SinglePhaseFluidProperties.h"
 
+#include <array>
+
 class BVFluidProperties : public Material
 {
 public:
   static InputParameters validParams();
   BVFluidProperties(const InputParameters & parameters);
   std::string phase_ext();
+  void initialSetup() override;
 
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
+  virtual void computeQpFluidProperties();
+  // Bicubic (Hermite) interpolation of density and viscosity in the p-T table
+  virtual void tableLookup(const ADReal & p, const ADReal & T, ADReal & rho, ADReal & mu) const;
+  void generateTable();
+  void readTable(const std::string & file_name);
+  // Node derivatives of a tabulated quantity by finite differences
+  void tableDerivatives(const unsigned int q, const bool values_only);
+  unsigned int tableNode(const unsigned int i, const unsigned int j) const
+  {
+    return j * _num_p + i;
+  }
 
   const ADVariableValue & _pf;
   const ADVariableValue & _temp;
@@ -37,4 +51,14 @@ protected:
 
   ADMaterialProperty<Real> & _density;
   ADMaterialProperty<Real> & _viscosity;
+
+  // Tabulated fluid properties
+  const bool _use_table;
+  const enum class OutOfRangeEnum { WARNING, ERROR } _out_of_range;
+  unsigned int _num_p;
+  unsigned int _num_T;
+  std::vector<Real> _p_grid;
+  std::vector<Real> _T_grid;
+  // Value, d/dp, d/dT and d2/dpdT at the nodes for density (0) and viscosity (1)
+  std::array<std::array<std::vector<Real>, 4>, 2> _table;
 };
\ No newline at end of file
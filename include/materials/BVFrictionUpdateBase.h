@@ -14,31 +14,50 @@
 #pragma once
 
 #include "Material.h"
+#include "BVReturnMapSolver.h"
 
-class BVFrictionUpdateBase : public Material
+class BVFrictionUpdateBase : public Material, public BVReturnMapSolver
 {
 public:
   static InputParameters validParams();
   BVFrictionUpdateBase(const InputParameters & parameters);
   void setQp(unsigned int qp);
-  virtual void frictionUpdate(ADRealVectorValue & traction, const RankTwoTensor & K);
+  void frictionUpdate(ADRealVectorValue & traction,
+                      const ADRealVectorValue & traction_incr,
+                      const Real & kn,
+                      const Real & ks);
   void resetQpProperties() final {}
   void resetProperties() final {}
 
 protected:
+  // Reset the quantities accumulated over the substeps
+  virtual void resetQpFrictionUpdate();
+  // Friction update over a single substep
+  virtual void substepUpdate(ADRealVectorValue & traction, const Real & kn, const Real & ks);
+  // Terms shared by the frictional strength and its derivative, evaluated once per iteration
+  // The Jacobian is always evaluated at the last point passed to residual()
+  virtual void preFrictionalStrength(const ADReal & delta_dot);
   virtual ADReal frictionalStrength(const ADReal & delta_dot) = 0;
   virtual ADReal frictionalStrengthDeriv(const ADReal & delta_dot) = 0;
   virtual ADReal returnMap();
+  virtual void returnMapBracket(ADReal & lower, ADReal & upper);
   virtual ADReal residual(const ADReal & delta_dot);
   virtual ADReal jacobian(const ADReal & delta_dot);
   virtual ADRealVectorValue reformSlipVector(const ADReal & delta_dot);
   virtual void preReturnMap();
   virtual void postReturnMap(const ADReal & delta_dot);
 
-  // Return map parameters
-  const Real _abs_tol;
-  const Real _rel_tol;
-  unsigned int _max_its;
+  // Name used as a prefix for all material properties related to this friction model
+  const std::string _base_name;
+
+  // Time increment of the current substep
+  Real _dt_sub;
+
+  // Number of iterations of the return map
+  MaterialProperty<Real> & _return_map_its;
+
+  // Inelastic slip accumulated over the substeps of the time step
+  MaterialProperty<Real> & _slip_incr;
 
   // Friction update parameters
   ADRealVectorValue _traction_tr;
@@ -0,0 +1,59 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Material.h"
+#include "SinglePhaseFluidProperties.h"
+
+/**
+ * Computes in a single pass the properties required for two-phase flow from the porosity,
+ * permeability, fluid properties of both phases, power law relative permeabilities and capillary
+ * pressure. Only the properties consumed by the kernels are stored (porosity, densities, mobility,
+ * fractional flows and saturation diffusivity), the intermediate quantities are kept local.
+ */
+class BVFusedMultiPhaseFlowMaterial : public Material
+{
+public:
+  static InputParameters validParams();
+  BVFusedMultiPhaseFlowMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  // Coupled variables
+  const ADVariableValue & _pf;
+  const ADVariableValue & _temp;
+  const ADVariableValue & _sw;
+
+  // Parameters
+  const Real _porosity0;
+  const Real _permeability0;
+  const Real _n_kr;
+  const Real _n_pc;
+  const Real _pce;
+  const SinglePhaseFluidProperties & _fp_w;
+  const SinglePhaseFluidProperties & _fp_n;
+
+  // Properties consumed by the time derivative kernels
+  ADMaterialProperty<Real> & _porosity;
+  ADMaterialProperty<Real> & _density_w;
+  ADMaterialProperty<Real> & _density_n;
+
+  // Flow properties
+  ADMaterialProperty<Real> & _lambda;
+  ADMaterialProperty<Real> & _f_w;
+  ADMaterialProperty<Real> & _f_n;
+  ADMaterialProperty<Real> & _D;
+};
\ No newline at end of file
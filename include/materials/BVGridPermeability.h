@@ -0,0 +1,33 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVPermeabilityBase.h"
+#include "BVStructuredGridData.h"
+
+class BVGridPermeability : public BVPermeabilityBase
+{
+public:
+  static InputParameters validParams();
+  BVGridPermeability(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  const BVStructuredGridData & _grid;
+  const std::vector<unsigned int> _components;
+
+  // Full permeability tensor, the scalar permeability being its mean diagonal value
+  MaterialProperty<RealTensorValue> & _permeability_tensor;
+};
\ No newline at end of file
@@ -14,19 +14,48 @@
 #pragma once
 
 #include "Material.h"
+#include "BVReturnMapSolver.h"
 
-class BVInelasticUpdateBase : public Material
+#include <limits>
+
+class BVInelasticUpdateBase : public Material, public BVReturnMapSolver
 {
 public:
   static InputParameters validParams();
   BVInelasticUpdateBase(const InputParameters & parameters);
   void setQp(unsigned int qp);
-  virtual void inelasticUpdate(ADRankTwoTensor & stress, const RankFourTensor & Cijkl) = 0;
+  // If provided, tangent holds dstress/dstrain_increment of the trial stress on input and of the
+  // updated stress on output
+  void inelasticUpdate(ADRankTwoTensor & stress,
+                       const ADRankTwoTensor & elastic_stress_incr,
+                       const Real & G,
+                       const Real & K,
+                       RankFourTensor * tangent = nullptr);
+  // Update of all quadrature points of the current element at once (no tangent)
+  virtual void inelasticUpdateBatch(ADMaterialProperty<RankTwoTensor> & stress,
+                                    const std::vector<ADRankTwoTensor> & elastic_stress_incr,
+                                    const Real & G,
+                                    const Real & K);
+  // Whether inelasticUpdateBatch is specialized, i.e. avoids the per qp return map
+  virtual bool hasBatchedUpdate() const { return false; }
+  // Derivative slots out of reach of the degrees of freedom, used to seed tangent computations
+  static dof_id_type tangentSlot(const unsigned int i)
+  {
+    return std::numeric_limits<dof_id_type>::max() - 1 - i;
+  }
   void resetQpProperties() final {}
   void resetProperties() final {}
 
 protected:
-  const Real _abs_tol;
-  const Real _rel_tol;
-  unsigned int _max_its;
+  // Reset the quantities accumulated over the substeps
+  virtual void resetQpInelasticUpdate() = 0;
+  // Inelastic update over a single substep (fills _substep_tangent if _compute_tangent)
+  virtual void substepUpdate(ADRankTwoTensor & stress, const Real & G, const Real & K) = 0;
+
+  // Time increment of the current substep
+  Real _dt_sub;
+
+  // Consistent tangent dstress/dtrial_stress of the current substep
+  bool _compute_tangent;
+  RankFourTensor _substep_tangent;
 };
\ No newline at end of file
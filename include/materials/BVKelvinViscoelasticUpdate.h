@@ -20,15 +20,26 @@ class BVKelvinViscoelasticUpdate : public BVCreepUpdateBase
 public:
   static InputParameters validParams();
   BVKelvinViscoelasticUpdate(const InputParameters & parameters);
+  virtual void inelasticUpdateBatch(ADMaterialProperty<RankTwoTensor> & stress,
+                                    const std::vector<ADRankTwoTensor> & elastic_stress_incr,
+                                    const Real & G,
+                                    const Real & K) override;
+  virtual bool hasBatchedUpdate() const override { return true; }
 
 protected:
   virtual void initQpStatefulProperties() override;
-  virtual ADReal creepRate(const ADReal & eqv_strain_incr) override;
-  virtual ADReal creepRateDerivative(const ADReal & eqv_strain_incr) override;
+  virtual std::array<ADReal, 1> returnMap() override;
+  virtual void returnMapDerivatives(const std::array<ADReal, 1> & creep_strain_incr,
+                                    std::array<Real, 1> & dincr_dq,
+                                    std::array<Real, 1> & dincr_dp) override;
+  virtual ADReal eqvCreepRate(const ADReal & eqv_strain_incr) override;
+  virtual ADReal eqvCreepRateDerivative(const ADReal & eqv_strain_incr) override;
   virtual ADReal kelvinCreepStrain(const ADReal & eqv_strain_incr);
   virtual ADReal kelvinCreepStrainDerivative(const ADReal & /*eqv_strain_incr*/);
-  virtual void preReturnMap() override;
-  virtual void postReturnMap(const ADReal & eqv_strain_incr) override;
+  virtual void resetQpInternalVariables() override;
+  virtual void postEqvReturnMap(const ADReal & eqv_strain_incr) override;
+  // Ratio of the equivalent creep strain increment to the effective stress driving the creep
+  Real creepFactor(const Real & G, const Real & dt) const;
 
   // Reference viscosity
   const Real _eta0;
@@ -36,6 +47,9 @@ protected:
   // Reference shear modulus
   const Real _G0;
 
+  // Time integration of the linear creep law
+  const enum class IntegrationEnum { BACKWARD_EULER, EXPONENTIAL } _integration;
+
   // Internal variable for creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain;
   const MaterialProperty<Real> & _eqv_creep_strain_old;
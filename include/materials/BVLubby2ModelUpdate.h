@@ -22,14 +22,14 @@ public:
   BVLubby2ModelUpdate(const InputParameters & parameters);
 
 protected:
-  virtual ADReal viscosityMaxwell(const std::vector<ADReal> & eqv_strain_incr) override;
-  virtual ADReal viscosityKelvin(const std::vector<ADReal> & eqv_strain_incr) override;
-  virtual ADReal viscosityMaxwellDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal viscosityMaxwell(const std::array<ADReal, 2> & eqv_strain_incr) override;
+  virtual ADReal viscosityKelvin(const std::array<ADReal, 2> & eqv_strain_incr) override;
+  virtual ADReal viscosityMaxwellDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                             const unsigned int j) override;
-  virtual ADReal viscosityKelvinDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal viscosityKelvinDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                            const unsigned int j) override;
-  virtual ADReal shearModulusKelvin(const std::vector<ADReal> & eqv_strain_incr) override;
-  virtual ADReal shearModulusKelvinDerivative(const std::vector<ADReal> & eqv_strain_incr,
+  virtual ADReal shearModulusKelvin(const std::array<ADReal, 2> & eqv_strain_incr) override;
+  virtual ADReal shearModulusKelvinDerivative(const std::array<ADReal, 2> & eqv_strain_incr,
                                               const unsigned int j) override;
 
   // Reference stress
@@ -20,11 +20,25 @@ class BVMaxwellViscoelasticUpdate : public BVCreepUpdateBase
 public:
   static InputParameters validParams();
   BVMaxwellViscoelasticUpdate(const InputParameters & parameters);
+  virtual void inelasticUpdateBatch(ADMaterialProperty<RankTwoTensor> & stress,
+                                    const std::vector<ADRankTwoTensor> & elastic_stress_incr,
+                                    const Real & G,
+                                    const Real & K) override;
+  virtual bool hasBatchedUpdate() const override { return true; }
 
 protected:
-  virtual ADReal creepRate(const ADReal & eqv_strain_incr) override;
-  virtual ADReal creepRateDerivative(const ADReal & eqv_strain_incr) override;
+  virtual std::array<ADReal, 1> returnMap() override;
+  virtual void returnMapDerivatives(const std::array<ADReal, 1> & creep_strain_incr,
+                                    std::array<Real, 1> & dincr_dq,
+                                    std::array<Real, 1> & dincr_dp) override;
+  virtual ADReal eqvCreepRate(const ADReal & eqv_strain_incr) override;
+  virtual ADReal eqvCreepRateDerivative(const ADReal & eqv_strain_incr) override;
+  // Ratio of the equivalent creep strain increment to the trial effective stress
+  Real creepFactor(const Real & G, const Real & dt) const;
 
   // Reference viscosity
   const Real _eta0;
+
+  // Time integration of the linear creep law
+  const enum class IntegrationEnum { BACKWARD_EULER, EXPONENTIAL } _integration;
 };
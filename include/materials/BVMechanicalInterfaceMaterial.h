@@ -16,6 +16,8 @@
 #include "InterfaceMaterial.h"
 #include "BVFrictionUpdateBase.h"
 
+#include <unordered_map>
+
 class BVMechanicalInterfaceMaterial : public InterfaceMaterial
 {
 public:
@@ -33,6 +35,8 @@ protected:
   virtual void computeQpLocalDisplacementJump();
   virtual void computeQpLocalTraction();
   virtual void computeQpGlobalTraction();
+  // Local frames of the qps of the current face, computed on the first visit of the face
+  virtual const std::vector<RankTwoTensor> & faceRotations();
   virtual RankTwoTensor computeReferenceRotation(const RealVectorValue & normal,
                                                  const unsigned int mesh_dimension);
 
@@ -51,7 +55,19 @@ protected:
   ADMaterialProperty<RealVectorValue> & _interface_displacement_jump_incr;
   ADMaterialProperty<RealVectorValue> & _interface_displacement_jump;
   const MaterialProperty<RealVectorValue> & _interface_displacement_jump_old;
-  MaterialProperty<RankTwoTensor> & _interface_total_rotation;
+
+  // Local frames (orthonormal bases) of the interface qps per face (element id, side), the fault
+  // geometry being fixed on the undisplaced mesh
+  struct FaceHash
+  {
+    std::size_t operator()(const std::pair<dof_id_type, unsigned int> & key) const
+    {
+      return std::hash<dof_id_type>()(key.first) ^ (std::hash<unsigned int>()(key.second) << 1);
+    }
+  };
+  std::unordered_map<std::pair<dof_id_type, unsigned int>, std::vector<RankTwoTensor>, FaceHash>
+      _face_rotations;
+  const std::vector<RankTwoTensor> * _rotations;
 
   // Traction properties
   ADMaterialProperty<RealVectorValue> & _interface_traction;
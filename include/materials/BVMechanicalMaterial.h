@@ -29,6 +29,7 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
   virtual void computeQpStrainIncrement();
   virtual void computeQpSmallStrain(const ADRankTwoTensor & grad_tensor,
@@ -37,6 +38,8 @@ protected:
                                      const RankTwoTensor & grad_tensor_old);
   virtual void computeQpElasticityTensor();
   virtual void computeQpStress();
+  virtual void checkQpTangent();
+  virtual ADRankTwoTensor elasticStressIncrement(const ADRankTwoTensor & strain_incr);
   virtual ADRankTwoTensor spinRotation(const ADRankTwoTensor & tensor);
 
   // Coupled variables
@@ -65,11 +68,21 @@ protected:
   // Elasticity tensor
   RankFourTensor _Cijkl;
 
+  // Consistent tangent dstress/dstrain_increment
+  const bool _check_tangent;
+  const bool _compute_tangent;
+  MaterialProperty<RankFourTensor> * _tangent;
+  MaterialProperty<Real> * _tangent_error;
+
   // Inelastic models
   unsigned int _num_inelastic;
   bool _has_inelastic;
   std::vector<BVInelasticUpdateBase *> _inelastic_models;
 
+  // Element-level update
+  bool _batched_update;
+  std::vector<ADRankTwoTensor> _elastic_stress_incr;
+
   // Initial stress
   unsigned int _num_ini_stress;
   std::vector<const Function *> _initial_stress;
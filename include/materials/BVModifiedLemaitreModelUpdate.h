@@ -23,13 +23,12 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
-  virtual ADReal creepRateR(const ADReal & eqv_strain_incr);
-  virtual ADReal creepRate(const ADReal & eqv_strain_incr) override;
-  virtual ADReal creepRateRDerivative(const ADReal & eqv_strain_incr);
-  virtual ADReal creepRateDerivative(const ADReal & eqv_strain_incr) override;
+  virtual void preEqvCreepRate(const ADReal & eqv_strain_incr) override;
+  virtual ADReal eqvCreepRate(const ADReal & eqv_strain_incr) override;
+  virtual ADReal eqvCreepRateDerivative(const ADReal & eqv_strain_incr) override;
   virtual ADReal lemaitreCreepStrain(const ADReal & eqv_strain_incr);
-  virtual void preReturnMap() override;
-  virtual void postReturnMap(const ADReal & eqv_strain_incr) override;
+  virtual void resetQpInternalVariables() override;
+  virtual void postEqvReturnMap(const ADReal & eqv_strain_incr) override;
 
   // Lemaitre creep strain rate parameters
   const Real _alpha;
@@ -37,6 +36,15 @@ protected:
   const Real _kr2;
   const Real _beta1;
   const Real _beta2;
+  const Real _inv_alpha;
+  const Real _inv_kr1;
+  const Real _inv_kr2;
+
+  // Terms shared by the creep rate and its derivative
+  ADReal _rate_R;
+  ADReal _rate_R_deriv;
+  ADReal _gamma_l;
+  ADReal _gamma_l_pow;
 
   // Internal variable for creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain;
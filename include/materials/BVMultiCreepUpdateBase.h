@@ -0,0 +1,88 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+
+#pragma once
+
+#include "BVInelasticUpdateBase.h"
+
+#include <array>
+
+/**
+ * Base class for a coupled return map of N creep mechanisms solved simultaneously for the N scalar
+ * creep strain increments. N is known at compile time so that the residual, Jacobian and Newton
+ * update live in fixed-size storage. Explicitly instantiated for N = 1, 2 and 3.
+ */
+template <unsigned int N>
+class BVMultiCreepUpdateBase : public BVInelasticUpdateBase
+{
+public:
+  static InputParameters validParams();
+  BVMultiCreepUpdateBase(const InputParameters & parameters);
+
+protected:
+  virtual void resetQpInelasticUpdate() override;
+  virtual void substepUpdate(ADRankTwoTensor & stress, const Real & G, const Real & K) override;
+  virtual std::array<ADReal, N> returnMap();
+  virtual void returnMapBracket(ADReal & lower, ADReal & upper);
+  virtual void residual(const std::array<ADReal, N> & creep_strain_incr,
+                        std::array<ADReal, N> & res);
+  virtual void jacobian(const std::array<ADReal, N> & creep_strain_incr,
+                        std::array<std::array<ADReal, N>, N> & jac);
+  virtual ADRankTwoTensor
+  reformPlasticStrainTensor(const std::array<ADReal, N> & creep_strain_incr);
+  // Terms shared by the creep rates and their derivatives, evaluated once per iteration
+  // The Jacobian is always evaluated at the last point passed to residual()
+  virtual void preCreepRate(const std::array<ADReal, N> & creep_strain_incr);
+  virtual ADReal creepRate(const std::array<ADReal, N> & creep_strain_incr,
+                           const unsigned int i) = 0;
+  virtual ADReal creepRateDerivative(const std::array<ADReal, N> & creep_strain_incr,
+                                     const unsigned int i,
+                                     const unsigned int j) = 0;
+  // Consistent tangent of the substep, dstress/dtrial_stress
+  virtual void computeQpTangent(const std::array<ADReal, N> & creep_strain_incr);
+  // Derivatives of the converged increments with respect to the trial effective and mean stresses
+  virtual void returnMapDerivatives(const std::array<ADReal, N> & creep_strain_incr,
+                                    std::array<Real, N> & dincr_dq,
+                                    std::array<Real, N> & dincr_dp);
+  // Derivative of the creep strain increment tensor with respect to the trial stress given the
+  // derivatives of the scalar increments with respect to the trial effective and mean stresses
+  virtual RankFourTensor creepStrainTangent(const std::array<Real, N> & creep_strain_incr,
+                                            const std::array<Real, N> & dincr_dq,
+                                            const std::array<Real, N> & dincr_dp);
+  // Tangent of a creep strain increment along the deviatoric flow direction
+  RankFourTensor deviatoricCreepStrainTangent(const Real & eqv_strain_incr,
+                                              const Real & dincr_dq,
+                                              const Real & dincr_dp);
+  virtual void resetQpInternalVariables();
+  virtual void preReturnMap();
+  virtual void postReturnMap(const std::array<ADReal, N> & creep_strain_incr);
+
+  // Name used as a prefix for all material properties related to this creep model
+  const std::string _base_name;
+
+  // Creep strain increment
+  ADMaterialProperty<RankTwoTensor> & _creep_strain_incr;
+
+  // Number of iterations of the return map
+  MaterialProperty<Real> & _return_map_its;
+
+  // Trial stress tensor, scalar effective stress and mean stress
+  ADRankTwoTensor _stress_tr;
+  ADReal _eqv_stress_tr;
+  ADReal _avg_stress_tr;
+
+  // Shear and bulk modulus
+  Real _G;
+  Real _K;
+};
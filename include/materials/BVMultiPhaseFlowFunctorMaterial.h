@@ -0,0 +1,66 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "FunctorMaterial.h"
+#include "SinglePhaseFluidProperties.h"
+
+/**
+ * Declares the fluid mobility, fractional flows and saturation diffusivity as functor properties.
+ * They are evaluated on demand, only on the elements a flux kernel actually requests. The phase
+ * mobilities (fluid properties and relative permeabilities) of an element are computed once and
+ * shared by all the functor properties for the duration of a residual or Jacobian evaluation. The
+ * fractional flows and the diffusivity are derived from them only where they are requested, and
+ * the diffusivity vanishes without any evaluation when there is no capillary pressure.
+ */
+class BVMultiPhaseFlowFunctorMaterial : public FunctorMaterial
+{
+public:
+  static InputParameters validParams();
+  BVMultiPhaseFlowFunctorMaterial(const InputParameters & parameters);
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void timestepSetup() override;
+
+protected:
+  // Mobilities of the wetting and non-wetting phases
+  struct PhaseMobilities
+  {
+    ADReal lambda_w;
+    ADReal lambda_n;
+  };
+
+  // Phase mobilities at a functor argument, memoized for element arguments
+  template <typename Space, typename Time>
+  PhaseMobilities phaseMobilities(const Space & r, const Time & t);
+  template <typename Space, typename Time>
+  PhaseMobilities computePhaseMobilities(const Space & r, const Time & t) const;
+
+  // Coupled functors
+  const Moose::Functor<ADReal> & _pf;
+  const Moose::Functor<ADReal> & _temp;
+  const Moose::Functor<ADReal> & _sw;
+
+  // Parameters
+  const Real _permeability;
+  const Real _n_kr;
+  const Real _n_pc;
+  const Real _pce;
+  const SinglePhaseFluidProperties & _fp_w;
+  const SinglePhaseFluidProperties & _fp_n;
+
+  // Phase mobilities per element, for each time state
+  const bool _cache_element_values;
+  std::vector<std::unordered_map<dof_id_type, PhaseMobilities>> _element_values;
+};
\ No newline at end of file
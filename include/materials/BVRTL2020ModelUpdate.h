@@ -23,27 +23,25 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
-  virtual ADReal creepRate(const std::vector<ADReal> & creep_strain_incr,
-                           const unsigned int i) override;
-  virtual ADReal creepRateR(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal creepRateLemaitre(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal creepRateMunsonDawson(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal creepRateDerivative(const std::vector<ADReal> & creep_strain_incr,
-                                     const unsigned int i,
-                                     const unsigned int j) override;
-  virtual ADReal creepRateRDerivative(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal creepRateLemaitreDerivative(const std::vector<ADReal> & creep_strain_incr,
-                                             const unsigned int /*j*/);
-  virtual ADReal creepRateMunsonDawsonDerivative(const std::vector<ADReal> & creep_strain_incr,
-                                                 const unsigned int j);
-  virtual ADReal lemaitreCreepStrain(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal munsondawsonCreepStrain(const std::vector<ADReal> & creep_strain_incr);
-  virtual ADReal volumetricCreepStrain(const std::vector<ADReal> & v_creep_strain_incr);
+  virtual void preCreepRate(const std::array<ADReal, 3> & creep_strain_incr) override;
+  virtual ADReal creepRateDev(const std::array<ADReal, 3> & creep_strain_incr,
+                              const unsigned int i) override;
+  virtual ADReal creepRateLemaitre();
+  virtual ADReal creepRateMunsonDawson();
+  virtual ADReal creepRateDevDerivative(const std::array<ADReal, 3> & creep_strain_incr,
+                                        const unsigned int i,
+                                        const unsigned int j) override;
+  virtual ADReal creepRateLemaitreDerivative(const unsigned int j);
+  virtual ADReal creepRateMunsonDawsonDerivative(const unsigned int j);
+  virtual ADReal lemaitreCreepStrain(const std::array<ADReal, 3> & creep_strain_incr);
+  virtual ADReal munsondawsonCreepStrain(const std::array<ADReal, 3> & creep_strain_incr);
+  virtual ADReal volumetricCreepStrain(const std::array<ADReal, 3> & creep_strain_incr);
+  virtual void resetQpInternalVariables() override;
   virtual void preReturnMap() override;
-  virtual void postReturnMap(const std::vector<ADReal> & creep_strain_incr) override;
-  virtual void preReturnMapVol(const std::vector<ADReal> & creep_strain_incr) override;
-  virtual ADReal creepRateVol(const ADReal & vol_strain_incr) override;
-  virtual ADReal creepRateVolDerivative(const ADReal & vol_strain_incr) override;
+  virtual void postReturnMap(const std::array<ADReal, 3> & creep_strain_incr) override;
+  virtual ADReal creepRateVol(const std::array<ADReal, 3> & creep_strain_incr) override;
+  virtual ADReal creepRateVolDerivative(const std::array<ADReal, 3> & creep_strain_incr,
+                                        const unsigned int j) override;
 
   // Temperature coupling
   const ADVariableValue * const _temp;
@@ -55,6 +53,8 @@ protected:
   const Real _alpha;
   const Real _A2;
   const Real _n2;
+  const Real _inv_alpha;
+  const Real _inv_A2;
 
   // Munson-Dawson creep strain rate parameters
   const Real _A1;
@@ -63,6 +63,7 @@ protected:
   const Real _B;
   const Real _m;
   const Real _n;
+  const Real _inv_A1;
 
   // Volumetric creep strain rate parameters
   const Real _z;
@@ -70,6 +71,8 @@ protected:
   const Real _nz;
   const Real _Mz;
   const Real _mz;
+  const Real _inv_Nz;
+  const Real _inv_Mz;
 
   // Internal variable for Lemaitre and Munson-Dawson creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain_L;
@@ -81,7 +84,18 @@ protected:
   ADMaterialProperty<Real> & _vol_creep_strain;
   const MaterialProperty<Real> & _vol_creep_strain_old;
 
-  // Scalar equivalent creep strain
+  // Scalar equivalent creep strain at the beginning of the substep
   ADReal _gamma_vp;
-  ADReal _gamma_dot_vp;
+
+  // Terms shared by the creep rates and their derivatives
+  ADReal _rate_R;
+  ADReal _rate_R_deriv;
+  ADReal _gamma_l;
+  ADReal _gamma_l_pow;
+  ADReal _saturation_strain;
+  ADReal _gamma_ms_ratio;
+  ADReal _gamma_ms_pow;
+  ADReal _p;
+  ADReal _pow_Nz;
+  ADReal _pow_Mz;
 };
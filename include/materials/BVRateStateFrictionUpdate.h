@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVFrictionUpdateBase.h"
+
+class BVRateStateFrictionUpdate : public BVFrictionUpdateBase
+{
+public:
+  static InputParameters validParams();
+  BVRateStateFrictionUpdate(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void resetQpFrictionUpdate() override;
+  virtual void preReturnMap() override;
+  virtual void postReturnMap(const ADReal & delta_dot) override;
+  virtual void preFrictionalStrength(const ADReal & delta_dot) override;
+  virtual ADReal frictionalStrength(const ADReal & delta_dot) override;
+  virtual ADReal frictionalStrengthDeriv(const ADReal & delta_dot) override;
+  // State variable at the end of the substep and its logarithmic derivative V / theta dtheta/dV
+  virtual void stateUpdate(const ADReal & delta_dot, ADReal & theta, ADReal & dlog_theta);
+  // Regularized friction coefficient and its derivative with respect to the slip rate
+  virtual void frictionCoefficient(const ADReal & delta_dot, ADReal & mu, ADReal & dmu);
+
+  // Friction parameters
+  const Real _a;
+  const Real _b;
+  const Real _f0;
+  const Real _V0;
+  const Real _L;
+  const Real _theta0;
+  const enum class StateEvolutionEnum { AGING, SLIP } _state_evolution;
+
+  // State variable at the beginning of the substep
+  Real _theta_n;
+
+  // Friction coefficient and its derivative at the current iterate
+  ADReal _mu;
+  ADReal _dmu;
+
+  // State variable, slip rate and friction coefficient
+  MaterialProperty<Real> & _theta;
+  const MaterialProperty<Real> & _theta_old;
+  MaterialProperty<Real> & _slip_rate;
+  MaterialProperty<Real> & _friction_coefficient;
+};
\ No newline at end of file
@@ -15,6 +15,17 @@
 
 #include "MeshGenerator.h"
 
+#include <array>
+#include <unordered_map>
+
+/**
+ * Splits the nodes of internal sidesets to create fault interfaces. Around each fault node, the
+ * elements connected through non-fault faces form one group, and every group beyond the first
+ * receives its own copy of the node. Curved faults, fault junctions (more than two copies) and
+ * fault tips (a single group, the node is not split) are therefore handled in one pass. All
+ * lookups are hashed and restricted to the fault nodes, and the new nodes are numbered
+ * consistently across processors so that distributed meshes can be split without gathering them.
+ */
 class BVFaultInterfaceGenerator : public MeshGenerator
 {
 public:
@@ -23,18 +34,50 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
-  std::map<boundary_id_type, std::set<dof_id_type>>
-  getSidesetNodes(const std::vector<BndElement *> & bnd_elems,
-                  const std::set<boundary_id_type> & mesh_sideset_ids);
-  std::map<boundary_id_type, std::set<std::vector<dof_id_type>>>
-  splitNodesOnInterface(const std::map<boundary_id_type, std::set<dof_id_type>> & bnd_node_ids,
-                        std::unique_ptr<MeshBase> & mesh);
-  void stitchNodesToElems(
-      const std::map<boundary_id_type, std::set<std::vector<dof_id_type>>> & split_nodes_map,
-      std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
-      const std::vector<BndElement *> & bnd_elems,
-      std::unique_ptr<MeshBase> & mesh);
+  // Element id -> sides of the element on a sideset
+  typedef std::unordered_map<dof_id_type, std::vector<unsigned int>> FaultSides;
+  // Pair of element ids sharing a face, smallest id first
+  typedef std::pair<dof_id_type, dof_id_type> FaceKey;
+  struct FaceKeyHash
+  {
+    std::size_t operator()(const FaceKey & key) const
+    {
+      return std::hash<dof_id_type>()(key.first) ^ (std::hash<dof_id_type>()(key.second) << 1);
+    }
+  };
+  typedef std::unordered_map<FaceKey, boundary_id_type, FaceKeyHash> FaultFaces;
+  // Node id, element id, element processor id and copy of the node attached to the element (0
+  // being the original node)
+  typedef std::array<dof_id_type, 4> NodeCopy;
+
+  std::map<boundary_id_type, FaultSides> getFaultSides(const MeshBase & mesh) const;
+  // Faces between two elements on a fault sideset (on either side)
+  FaultFaces getFaultFaces(const MeshBase & mesh,
+                           const std::map<boundary_id_type, FaultSides> & fault_sides) const;
+  // Sorted ids of the nodes on the fault sidesets known by this processor
+  std::vector<dof_id_type>
+  getSidesetNodes(const MeshBase & mesh,
+                  const std::map<boundary_id_type, FaultSides> & fault_sides) const;
+  // Elements attached to each fault node, sorted by id
+  std::unordered_map<dof_id_type, std::vector<Elem *>>
+  buildNodeToElemMap(MeshBase & mesh, const std::vector<dof_id_type> & fault_nodes) const;
+  // Reference orientation of each sideset given by its first element
+  std::map<boundary_id_type, RealVectorValue>
+  referenceNormals(
+      const MeshBase & mesh,
+      const std::map<boundary_id_type, FaultSides> & fault_sides,
+      const std::unordered_map<dof_id_type, std::vector<Elem *>> & node_to_elems) const;
+  // Copy of each fault node attached to each of its elements, for the nodes owned by this
+  // processor (all nodes on replicated meshes)
+  std::vector<NodeCopy>
+  splitNodes(const MeshBase & mesh,
+             const std::vector<dof_id_type> & fault_nodes,
+             const FaultFaces & fault_faces,
+             const std::map<boundary_id_type, RealVectorValue> & normals,
+             const std::unordered_map<dof_id_type, std::vector<Elem *>> & node_to_elems) const;
+  // Create the node copies and attach them to the elements
+  void stitchNodesToElems(std::vector<NodeCopy> & node_copies, MeshBase & mesh) const;
 
   std::unique_ptr<MeshBase> & _input;
   const std::vector<BoundaryName> _sideset_names;
-};
+};
\ No newline at end of file
@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+class BVCFLTimeStep : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVCFLTimeStep(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  const Real _cfl;
+  const Real _max_dfds;
+  const Real _max_dt;
+
+  const ADVariableGradient & _grad_p;
+  const ADMaterialProperty<Real> & _lambda;
+  const ADMaterialProperty<Real> & _porosity;
+
+  // Smallest stable time step
+  Real _dt_cfl;
+};
\ No newline at end of file
@@ -0,0 +1,36 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InterfacePostprocessor.h"
+
+class BVInterfaceMaterialPropertyValue : public InterfacePostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVInterfaceMaterialPropertyValue(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  const MaterialProperty<Real> & _mat_prop;
+  const enum class ValueType { MAX, MIN, AVERAGE } _value_type;
+
+  // Extreme value or integral and area of the interface
+  Real _value;
+  Real _area;
+};
\ No newline at end of file
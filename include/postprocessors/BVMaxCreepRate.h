@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+class BVMaxCreepRate : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVMaxCreepRate(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  const std::string _base_name;
+  const ADMaterialProperty<RankTwoTensor> & _creep_strain_incr;
+
+  // Largest equivalent creep rate
+  Real _max_creep_rate;
+};
\ No newline at end of file
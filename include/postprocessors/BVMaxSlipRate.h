@@ -0,0 +1,38 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InterfacePostprocessor.h"
+
+class BVMaxSlipRate : public InterfacePostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVMaxSlipRate(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  // Name used as a prefix for the properties of the friction model
+  const std::string _base_name;
+
+  // Inelastic slip increment computed by the friction model
+  const MaterialProperty<Real> & _slip_incr;
+
+  // Largest slip rate
+  Real _max_slip_rate;
+};
\ No newline at end of file
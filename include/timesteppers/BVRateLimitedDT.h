@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "TimeStepper.h"
+
+class BVRateLimitedDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+  BVRateLimitedDT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  // Maximum rates and the largest increments allowed over a time step
+  std::vector<const PostprocessorValue *> _rates;
+  const std::vector<Real> _max_increments;
+
+  const Real _dt0;
+  const Real _growth_factor;
+  const Real _max_dt;
+};
\ No newline at end of file
@@ -0,0 +1,74 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <tuple>
+#include <unordered_map>
+
+class FaceInfo;
+
+/**
+ * Per-face cache of the Darcy velocities shared by the finite volume flux kernels. The cache is
+ * keyed by face, pressure variable and cache identifier, and cleared at the start of every
+ * residual and Jacobian evaluation. All kernels using the same identifier must compute the same
+ * Darcy velocity (same mobility and gravity weights), the first one filling the cache.
+ */
+class BVFVFaceCache : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  BVFVFaceCache(const InputParameters & parameters);
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
+  // Index of a cache identifier, registered on first request
+  unsigned int cacheId(const std::string & name) const;
+  // Cached Darcy velocity on a face, nullptr if not computed yet
+  const ADRealVectorValue * darcyVelocity(const FaceInfo & fi,
+                                          const unsigned int var_num,
+                                          const unsigned int cache_id,
+                                          const THREAD_ID tid) const;
+  // Store the Darcy velocity on a face
+  const ADRealVectorValue & cacheDarcyVelocity(const FaceInfo & fi,
+                                               const unsigned int var_num,
+                                               const unsigned int cache_id,
+                                               const THREAD_ID tid,
+                                               const ADRealVectorValue & vel) const;
+
+protected:
+  void clearCache();
+
+  // Face, pressure variable number and cache identifier
+  typedef std::tuple<const FaceInfo *, unsigned int, unsigned int> FaceKey;
+  struct FaceKeyHash
+  {
+    std::size_t operator()(const FaceKey & key) const
+    {
+      return std::hash<const FaceInfo *>()(std::get<0>(key)) ^
+             (std::hash<unsigned int>()(std::get<1>(key)) << 1) ^
+             (std::hash<unsigned int>()(std::get<2>(key)) << 2);
+    }
+  };
+
+  // Registered cache identifiers
+  mutable std::vector<std::string> _cache_ids;
+
+  // Darcy velocities per thread (faces are visited by a single thread per evaluation)
+  mutable std::vector<std::unordered_map<FaceKey, ADRealVectorValue, FaceKeyHash>> _darcy_velocity;
+};
\ No newline at end of file
@@ -0,0 +1,60 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <unordered_map>
+
+/**
+ * Memory-mapped binary structured grid used to sample heterogeneous properties per element. The
+ * file is only mapped, never read as a whole, so each rank only touches the pages of the cells
+ * containing its elements. The cell containing the centroid of the local elements and of their
+ * point neighbors is precomputed, other elements are located on demand.
+ */
+class BVStructuredGridData : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  BVStructuredGridData(const InputParameters & parameters);
+  virtual ~BVStructuredGridData();
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+  virtual void meshChanged() override;
+
+  // Component of the grid cell containing the element centroid
+  Real value(const Elem * elem, const unsigned int component) const;
+  unsigned int numComponents() const { return _num_components; }
+
+protected:
+  void mapFile();
+  void buildElementIndex();
+  // Index of the cell containing a point, points outside of the grid use the nearest cell
+  std::size_t cellIndex(const Point & p) const;
+
+  // Grid geometry
+  const Point _origin;
+  const RealVectorValue _cell_size;
+  std::array<std::size_t, 3> _num_cells;
+  const unsigned int _num_components;
+
+  // Memory-mapped data
+  int _fd;
+  std::size_t _map_size;
+  const double * _data;
+
+  // Cell index of the local elements and their point neighbors
+  std::unordered_map<dof_id_type, std::size_t> _elem_to_cell;
+};
\ No newline at end of file
@@ -0,0 +1,67 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+namespace BVMultiPhaseFlowTools
+{
+
+/**
+ * Power law relative permeabilities of the wetting and non-wetting phases
+ */
+template <typename T>
+void
+powerLawRelativePermeabilities(const T & sw, const Real & n, T & kr_w, T & kr_n)
+{
+  kr_w = std::pow(sw, n);
+  kr_n = std::pow(1.0 - sw, n);
+}
+
+/**
+ * Power law capillary pressure and its derivative with respect to the wetting saturation
+ */
+template <typename T>
+void
+powerLawCapillaryPressure(const T & sw, const Real & n, const Real & pce, T & pc, T & dpc)
+{
+  if (pce == 0.0)
+  {
+    pc = dpc = 0.0;
+    return;
+  }
+
+  pc = pce * std::pow(sw, -n);
+  dpc = -n * pc / sw;
+}
+
+/**
+ * Total mobility, fractional flows and saturation diffusivity from the phase mobilities and the
+ * capillary pressure derivative
+ */
+template <typename T>
+void
+flowProperties(const T & lambda_w,
+               const T & lambda_n,
+               const T & dpc,
+               T & lambda,
+               T & f_w,
+               T & f_n,
+               T & D)
+{
+  lambda = lambda_w + lambda_n;
+  f_w = lambda_w / lambda;
+  f_n = lambda_n / lambda;
+  D = lambda_w * lambda_n / lambda * dpc;
+}
+
+}
\ No newline at end of file
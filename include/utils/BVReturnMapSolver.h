@@ -0,0 +1,297 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InputParameters.h"
+#include "MooseException.h"
+#include "MooseTypes.h"
+
+#include <array>
+
+/**
+ * Iterative solver shared by the return maps of the inelastic and friction updates. Solves
+ * R(x) = 0 for N unknowns with Newton-Raphson, optionally damped by a backtracking line search, or
+ * for a single unknown with Newton-Raphson safeguarded by bisection inside a bracket of the
+ * solution. Damped and bisection steps end with one full Newton step so that the derivatives of
+ * the solution are consistent (implicit function theorem).
+ */
+class BVReturnMapSolver
+{
+public:
+  static InputParameters validParams();
+  BVReturnMapSolver(const InputParameters & parameters);
+  unsigned int maxSubsteps() const { return _max_substeps; }
+
+protected:
+  // Newton-Raphson (with line search if requested) on N unknowns starting from x
+  // residual(x, res) and jacobian(x, jac); the Jacobian is evaluated after the residual at x
+  template <unsigned int N, typename Residual, typename Jacobian>
+  void newtonSolve(std::array<ADReal, N> & x,
+                   const Residual & residual,
+                   const Jacobian & jacobian,
+                   Real & its) const;
+  // Scalar version of newtonSolve with res = residual(x) and jac = jacobian(x)
+  template <typename Residual, typename Jacobian>
+  ADReal newtonSolve(const ADReal & x0,
+                     const Residual & residual,
+                     const Jacobian & jacobian,
+                     Real & its) const;
+  // Newton-Raphson safeguarded by bisection on a single unknown in [lower, upper]
+  template <typename Residual, typename Jacobian>
+  ADReal bracketedSolve(const ADReal & lower,
+                        const ADReal & upper,
+                        const Residual & residual,
+                        const Jacobian & jacobian,
+                        Real & its) const;
+  // Full Newton update x -= jac^{-1} res
+  template <unsigned int N>
+  static void nrStep(const std::array<ADReal, N> & res,
+                     std::array<std::array<ADReal, N>, N> & jac,
+                     std::array<ADReal, N> & x);
+  // Solve jac * x = vec in place with a dense LU decomposition (partial pivoting)
+  template <unsigned int N>
+  static void luSolve(std::array<std::array<ADReal, N>, N> & jac, std::array<ADReal, N> & vec);
+  template <unsigned int N>
+  static ADReal norm(const std::array<ADReal, N> & vec);
+
+  bool converged(const ADReal & res_norm, const ADReal & res_ini) const
+  {
+    return (res_norm <= _abs_tol) || (res_norm / res_ini <= _rel_tol);
+  }
+
+  // Return map parameters
+  const Real _abs_tol;
+  const Real _rel_tol;
+  unsigned int _max_its;
+  const enum class SolverEnum { NEWTON, LINE_SEARCH, BRACKETED } _solver;
+  const bool _value_only;
+  const unsigned int _max_substeps;
+};
+
+template <unsigned int N, typename Residual, typename Jacobian>
+void
+BVReturnMapSolver::newtonSolve(std::array<ADReal, N> & x,
+                               const Residual & residual,
+                               const Jacobian & jacobian,
+                               Real & its) const
+{
+  std::array<ADReal, N> res;
+  std::array<std::array<ADReal, N>, N> jac;
+
+  // Initial residual
+  residual(x, res);
+  jacobian(x, jac);
+  const ADReal res_ini = norm<N>(res);
+  ADReal res_norm = res_ini;
+  const Real its_ini = its;
+
+  // Newton loop
+  for (unsigned int iter = 0; iter < _max_its; ++iter)
+  {
+    its = its_ini + iter + 1;
+
+    // Newton direction
+    std::array<ADReal, N> dx = res;
+    luSolve<N>(jac, dx);
+
+    if (_solver == SolverEnum::LINE_SEARCH)
+    {
+      // Backtracking until the residual norm decreases sufficiently
+      const std::array<ADReal, N> x_0 = x;
+      const ADReal res_norm_0 = res_norm;
+      Real alpha = 1.0;
+      for (unsigned int ls = 0; ls < 10; ++ls)
+      {
+        for (unsigned int i = 0; i < N; ++i)
+          x[i] = x_0[i] - alpha * dx[i];
+
+        residual(x, res);
+        res_norm = norm<N>(res);
+
+        if (std::isfinite(MetaPhysicL::raw_value(res_norm)) &&
+            res_norm <= (1.0 - 1.0e-04 * alpha) * res_norm_0)
+          break;
+
+        alpha *= 0.5;
+      }
+    }
+    else
+    {
+      for (unsigned int i = 0; i < N; ++i)
+        x[i] -= dx[i];
+      residual(x, res);
+      res_norm = norm<N>(res);
+    }
+
+    jacobian(x, jac);
+
+    // Convergence check
+    if (converged(res_norm, res_ini))
+    {
+      // Damped steps: one full Newton step to recover consistent derivatives
+      if (_solver == SolverEnum::LINE_SEARCH)
+        nrStep<N>(res, jac, x);
+      return;
+    }
+  }
+  throw MooseException(
+      "BVReturnMapSolver: maximum number of iterations exceeded in 'returnMap'!");
+}
+
+template <typename Residual, typename Jacobian>
+ADReal
+BVReturnMapSolver::newtonSolve(const ADReal & x0,
+                               const Residual & residual,
+                               const Jacobian & jacobian,
+                               Real & its) const
+{
+  std::array<ADReal, 1> x = {{x0}};
+  newtonSolve<1>(
+      x,
+      [&residual](const std::array<ADReal, 1> & y, std::array<ADReal, 1> & res)
+      { res[0] = residual(y[0]); },
+      [&jacobian](const std::array<ADReal, 1> & y, std::array<std::array<ADReal, 1>, 1> & jac)
+      { jac[0][0] = jacobian(y[0]); },
+      its);
+  return x[0];
+}
+
+template <typename Residual, typename Jacobian>
+ADReal
+BVReturnMapSolver::bracketedSolve(const ADReal & lower,
+                                  const ADReal & upper,
+                                  const Residual & residual,
+                                  const Jacobian & jacobian,
+                                  Real & its) const
+{
+  const ADReal res_upper = residual(upper);
+
+  // Initial residual
+  ADReal x = lower;
+  ADReal res = residual(x);
+  ADReal jac = jacobian(x);
+  const ADReal res_ini = std::abs(res);
+
+  if (res_ini == 0.0)
+    return x;
+
+  // Orient the bracket: positive residual at x_pos, negative residual at x_neg
+  ADReal x_pos = lower;
+  ADReal x_neg = upper;
+  if (res < 0.0)
+    std::swap(x_pos, x_neg);
+  if (res * res_upper > 0.0) // No sign change: the bracket is of no use
+    x_neg = x_pos = x;
+
+  const Real its_ini = its;
+
+  // Safeguarded Newton loop
+  for (unsigned int iter = 0; iter < _max_its; ++iter)
+  {
+    its = its_ini + iter + 1;
+
+    x -= res / jac;
+
+    // Bisection if the Newton step leaves the bracket
+    if (x_pos != x_neg &&
+        (!std::isfinite(MetaPhysicL::raw_value(x)) || (x - x_pos) * (x - x_neg) > 0.0))
+      x = 0.5 * (x_pos + x_neg);
+
+    res = residual(x);
+    jac = jacobian(x);
+
+    // Convergence check
+    if (converged(std::abs(res), res_ini))
+      // Bisection steps: one full Newton step to recover consistent derivatives
+      return x - res / jac;
+
+    // Shrink the bracket
+    if (x_pos != x_neg)
+    {
+      if (res > 0.0)
+        x_pos = x;
+      else
+        x_neg = x;
+    }
+  }
+  throw MooseException(
+      "BVReturnMapSolver: maximum number of iterations exceeded in 'returnMap'!");
+}
+
+template <unsigned int N>
+void
+BVReturnMapSolver::nrStep(const std::array<ADReal, N> & res,
+                          std::array<std::array<ADReal, N>, N> & jac,
+                          std::array<ADReal, N> & x)
+{
+  std::array<ADReal, N> dx = res;
+  luSolve<N>(jac, dx);
+
+  for (unsigned int i = 0; i < N; ++i)
+    x[i] -= dx[i];
+}
+
+template <unsigned int N>
+void
+BVReturnMapSolver::luSolve(std::array<std::array<ADReal, N>, N> & jac, std::array<ADReal, N> & vec)
+{
+  for (unsigned int k = 0; k < N; ++k)
+  {
+    // Pivoting
+    unsigned int p = k;
+    for (unsigned int i = k + 1; i < N; ++i)
+      if (std::abs(jac[i][k]) > std::abs(jac[p][k]))
+        p = i;
+
+    if (jac[p][k] == 0.0)
+      throw MooseException("BVReturnMapSolver: matrix is singular in 'returnMap'!");
+
+    if (p != k)
+    {
+      std::swap(jac[p], jac[k]);
+      std::swap(vec[p], vec[k]);
+    }
+
+    // Elimination
+    for (unsigned int i = k + 1; i < N; ++i)
+    {
+      const ADReal l = jac[i][k] / jac[k][k];
+      for (unsigned int j = k + 1; j < N; ++j)
+        jac[i][j] -= l * jac[k][j];
+      vec[i] -= l * vec[k];
+    }
+  }
+
+  // Back substitution
+  for (unsigned int k = N; k-- > 0;)
+  {
+    for (unsigned int j = k + 1; j < N; ++j)
+      vec[k] -= jac[k][j] * vec[j];
+    vec[k] /= jac[k][k];
+  }
+}
+
+template <unsigned int N>
+ADReal
+BVReturnMapSolver::norm(const std::array<ADReal, N> & vec)
+{
+  if (N == 1)
+    return std::abs(vec[0]);
+
+  ADReal sum = 0.0;
+  for (unsigned int i = 0; i < N; ++i)
+    sum += vec[i] * vec[i];
+
+  return std::sqrt(sum);
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 20
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[AuxVariables]
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.01
+  []
+  [u]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+  []
+[]
+
+[AuxKernels]
+  [u_aux]
+    type = BVDarcyVelocityAux
+    variable = u
+    fluid_pressure = p
+    component = x
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[FVBCs]
+  [leftinflux_pw]
+    type = FVNeumannBC
+    variable = p
+    value = 1.0
+    boundary = 'left'
+  []
+  [rightoutflux_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 0.0
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[MultiApps]
+  [transport]
+    type = TransientMultiApp
+    input_files = 'fv_multi_phase_buckley_leverett_impes_transport.i'
+    execute_on = 'TIMESTEP_END'
+    sub_cycling = true
+  []
+[]
+
+[Transfers]
+  [cfl_dt_from_transport]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = transport
+    from_postprocessor = cfl_dt
+    to_postprocessor = cfl_dt
+    reduction_type = minimum
+  []
+  [to_transport]
+    type = MultiAppCopyTransfer
+    to_multi_app = transport
+    source_variable = p
+    variable = p
+  []
+  [from_transport]
+    type = MultiAppCopyTransfer
+    from_multi_app = transport
+    source_variable = sw
+    variable = sw
+  []
+[]
+
+[Postprocessors]
+  [cfl_dt]
+    type = Receiver
+    default = 0.0025
+  []
+  [sw_avg]
+    type = ElementAverageValue
+    variable = sw
+  []
+  [sw_l2]
+    type = ElementL2Norm
+    variable = sw
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_hypre_type'
+    petsc_options_value = 'hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 0.3
+  timestep_tolerance = 1.0e-05
+  # Update the total pressure at the CFL time step of the transport
+  [TimeStepper]
+    type = PostprocessorDT
+    postprocessor = cfl_dt
+    dt = 0.0025
+  []
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'INITIAL TIMESTEP_END'
+  exodus = true
+  csv = true
+[]
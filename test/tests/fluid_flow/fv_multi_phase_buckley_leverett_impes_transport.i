@@ -0,0 +1,141 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 20
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.01
+  []
+[]
+
+[AuxVariables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[FVKernels]
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+  []
+[]
+
+[FVBCs]
+  [leftinflux_sw]
+    type = FVNeumannBC
+    variable = sw
+    value = 1.0
+    boundary = 'left'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 0.0
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[Postprocessors]
+  [cfl_dt]
+    type = BVCFLTimeStep
+    total_pressure = p
+    cfl = 0.5
+    # Maximum slope of the fractional flow for quadratic relative permeabilities
+    max_fractional_flow_derivative = 2.0
+    max_dt = 0.05
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_hypre_type'
+    petsc_options_value = 'hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  [TimeStepper]
+    type = PostprocessorDT
+    postprocessor = cfl_dt
+    dt = 0.0025
+  []
+[]
+
+[Outputs]
+  print_linear_residuals = false
+[]
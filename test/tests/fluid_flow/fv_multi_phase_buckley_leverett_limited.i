@@ -0,0 +1,237 @@
+# Buckley-Leverett front transported with the van Leer limited fractional flow, compared with
+# the upwind front of fv_multi_phase_buckley_leverett_front.i
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 50
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.05
+  []
+  [sn]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.95
+  []
+[]
+
+[AuxVariables]
+  [mixing]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [mixing_aux]
+    type = ParsedAux
+    variable = mixing
+    coupled_variables = 'sw'
+    expression = '(sw - 0.05) * (0.95 - sw)'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+  []
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+    advected_interp_method = vanLeer
+  []
+  # Non-wetting phase
+  [time_nw]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sn
+    phase = 'non_wetting'
+  []
+  [darcy_nw]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sn
+    total_pressure = p
+    phase = 'non_wetting'
+    advected_interp_method = vanLeer
+  []
+[]
+
+[FVBCs]
+  [leftinflux_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 1.0
+    boundary = 'left'
+  []
+  [right_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+  [leftinflux_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.95
+    boundary = 'left'
+  []
+  [right_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.05
+    boundary = 'right'
+  []
+  [leftinflux_sn]
+    type = FVDirichletBC
+    variable = sn
+    value = 0.05
+    boundary = 'left'
+  []
+  [right_sn]
+    type = FVDirichletBC
+    variable = sn
+    value = 0.95
+    boundary = 'right'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 1.0e-04
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[Postprocessors]
+  [mixing]
+    # Vanishes for a sharp front between the injected and initial saturations
+    type = ElementIntegralVariablePostprocessor
+    variable = mixing
+    outputs = none
+  []
+  [upwind_mixing]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = upwind
+    vector_name = mixing
+    index = 0
+    outputs = none
+  []
+  [sharper]
+    # 1 if the limited front is sharper than the upwind one
+    type = ParsedPostprocessor
+    pp_names = 'mixing upwind_mixing'
+    expression = 'if(mixing < upwind_mixing, 1, 0)'
+  []
+[]
+
+[VectorPostprocessors]
+  [upwind]
+    type = CSVReader
+    csv_file = 'reference/fv_multi_phase_buckley_leverett_front_upwind.csv'
+    outputs = none
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew -snes_converged_reason -ksp_converged_reason'
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -snes_atol -snes_max_it -snes_linesearch_type'
+    petsc_options_value = 'hypre boomeramg
+                           1.0e-10 1000 basic'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 0.3
+  num_steps = 30
+  dt = 0.01
+  timestep_tolerance = 1.0e-05
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'FINAL'
+  csv = true
+[]
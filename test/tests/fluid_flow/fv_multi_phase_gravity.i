@@ -0,0 +1,202 @@
+# Closed vertical column of two immiscible fluids without capillarity: the total velocity vanishes
+# and the heavier wetting phase segregates downwards at rate lambda * f_w * f_n * (rho_w - rho_n) * g
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmin = 0
+  xmax = 1
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.5
+  []
+  [sn]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.5
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+    gravity = '-1 0 0'
+  []
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+    gravity = '-1 0 0'
+  []
+  # Non-wetting phase
+  [time_nw]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sn
+    phase = 'non_wetting'
+  []
+  [darcy_nw]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sn
+    total_pressure = p
+    phase = 'non_wetting'
+    gravity = '-1 0 0'
+  []
+[]
+
+[FVBCs]
+  [p_top]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+[]
+
+[Functions]
+  [p_exact]
+    # Hydrostatic pressure of the mixture density rho = f_w * rho_w + f_n * rho_n
+    type = ParsedFunction
+    expression = 'rho * (1 - x)'
+    symbol_names = 'rho'
+    symbol_values = '1.5'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 0.0
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 2.0
+    viscosity = 1.0
+    thermal_expansion = 0.0
+    bulk_modulus = 1.0e+30
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+    thermal_expansion = 0.0
+    bulk_modulus = 1.0e+30
+  []
+[]
+
+[Postprocessors]
+  [error]
+    type = ElementL2Error
+    variable = p
+    function = p_exact
+  []
+  [sw_top]
+    type = PointValue
+    variable = sw
+    point = '0.95 0 0'
+    outputs = none
+  []
+  [sw_bottom]
+    type = PointValue
+    variable = sw
+    point = '0.05 0 0'
+    outputs = none
+  []
+  [sw_ini]
+    type = PointValue
+    variable = sw
+    point = '0.55 0 0'
+    execute_on = 'INITIAL'
+    outputs = none
+  []
+  [dt]
+    type = TimestepSize
+    outputs = none
+  []
+  [dsw_dt_top]
+    type = ParsedPostprocessor
+    pp_names = 'sw_top sw_ini dt'
+    expression = '(sw_top - sw_ini) / dt'
+  []
+  [dsw_dt_bottom]
+    type = ParsedPostprocessor
+    pp_names = 'sw_bottom sw_ini dt'
+    expression = '(sw_bottom - sw_ini) / dt'
+  []
+[]
+
+[Preconditioning]
+  [lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 1
+  dt = 1.0e-06
+  nl_abs_tol = 1.0e-12
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
@@ -0,0 +1,92 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmin = 0
+  xmax = 100
+[]
+
+[Variables]
+  [pf]
+    type = MooseVariableFVReal
+  []
+[]
+
+[FVKernels]
+  [darcy]
+    type = BVFVSinglePhaseDarcy
+    variable = pf
+    gravity = '-1 0 0'
+    two_point_flux = true
+  []
+[]
+
+[FVBCs]
+  [p_top]
+    type = FVDirichletBC
+    variable = pf
+    boundary = right
+    value = 0
+  []
+[]
+
+[Functions]
+  [pf_exact]
+    type = ParsedFunction
+    expression = '100 - x'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+    thermal_expansion = 0.0
+    bulk_modulus = 1.0e+30
+  []
+[]
+
+[Postprocessors]
+  [error]
+    type = ElementL2Error
+    variable = pf
+    function = pf_exact
+  []
+[]
+
+[Preconditioning]
+  [lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1.0e-12
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
@@ -0,0 +1,159 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 50
+  xmin = 0
+  xmax = 1
+[]
+
+[Variables]
+  [pf]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [c]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [s]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[ICs]
+  [pf_ic]
+    type = FunctionIC
+    variable = pf
+    function = '1-x'
+  []
+[]
+
+[FVKernels]
+  [darcy_p]
+    type = BVFVSinglePhaseDarcy
+    variable = pf
+  []
+  [time_derivative_c]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = c
+  []
+  [time_derivative_s]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = s
+  []
+  # Reference for the multi-species kernel: one kernel per species
+  [darcy_c]
+    type = BVFVSinglePhaseSoluteDarcy
+    variable = c
+    fluid_pressure = pf
+  []
+  [darcy_s]
+    type = BVFVSinglePhaseSoluteDarcy
+    variable = s
+    fluid_pressure = pf
+  []
+[]
+
+[FVBCs]
+  [p_left]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'left'
+    value = 1
+  []
+  [p_right]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'right'
+    value = 0
+  []
+  [c_left]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'left'
+    value = 1
+  []
+  [c_right]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'right'
+    value = 0
+  []
+  [s_left]
+    type = FVDirichletBC
+    variable = s
+    boundary = 'left'
+    value = 0.5
+  []
+  [s_right]
+    type = FVDirichletBC
+    variable = s
+    boundary = 'right'
+    value = 0
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [solute_mat]
+    type = BVSinglePhaseFlowSoluteMaterial
+  []
+  [dispersion]
+    type = BVConstantDispersion
+    dispersion = 1.0e-03
+  []
+  [fluid_properties]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-snes_linesearch_type -pc_type -pc_hypre_type'
+    petsc_options_value = 'bt hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+  start_time = 0
+  end_time = 0.1
+  num_steps = 5
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  perf_graph = true
+  exodus = true
+[]
@@ -0,0 +1,73 @@
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+  []
+  [skew]
+    type = ParsedNodeTransformGenerator
+    input = gmg
+    x_function = 'x + 0.3 * y'
+    y_function = 'y'
+    z_function = 'z'
+  []
+[]
+
+[Variables]
+  [pf]
+    type = MooseVariableFVReal
+  []
+[]
+
+[FVKernels]
+  [darcy]
+    type = BVFVSinglePhaseDarcy
+    variable = pf
+    two_point_flux = true
+  []
+[]
+
+[FVBCs]
+  [p_left]
+    type = FVDirichletBC
+    variable = pf
+    boundary = left
+    value = 1
+  []
+  [p_right]
+    type = FVDirichletBC
+    variable = pf
+    boundary = right
+    value = 0
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
@@ -164,6 +164,23 @@
   []
 []
 
+[Postprocessors]
+  [max_its]
+    type = BVInterfaceMaterialPropertyValue
+    boundary = 'interface'
+    mat_prop = friction_return_map_iterations
+    value_type = max
+    outputs = csv
+  []
+  [avg_its]
+    type = BVInterfaceMaterialPropertyValue
+    boundary = 'interface'
+    mat_prop = friction_return_map_iterations
+    value_type = average
+    outputs = csv
+  []
+[]
+
 # [Preconditioning]
 #   [hypre]
 #     type = SMP
@@ -200,4 +217,5 @@
 
 [Outputs]
   exodus = true
+  csv = true
 []
@@ -0,0 +1,94 @@
+# Four blocks meeting at the center: the center node is split in four, the other fault nodes in two
+# 25 nodes + 8 + 3 = 36 nodes
+# Sum of the squared number of elements per node: 4 x 1 (corners) + 8 x 4 (boundary) + 4 x 16
+# (interior) + 8 x 1 (boundary fault copies) + 8 x 4 (interior fault copies) + 4 x 1 (center) = 144
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+  []
+  [right]
+    type = SubdomainBoundingBoxGenerator
+    input = gen
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 0.5 0'
+  []
+  [top_left]
+    type = SubdomainBoundingBoxGenerator
+    input = right
+    block_id = 2
+    bottom_left = '0 0.5 0'
+    top_right = '0.5 1 0'
+  []
+  [top_right]
+    type = SubdomainBoundingBoxGenerator
+    input = top_left
+    block_id = 3
+    bottom_left = '0.5 0.5 0'
+    top_right = '1 1 0'
+  []
+  [faults]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = top_right
+    primary_block = '0 3'
+    paired_block = '1 2'
+    new_boundary = 'faults'
+  []
+  [interface_gen]
+    type = BVFaultInterfaceGenerator
+    input = faults
+    sidesets = 'faults'
+  []
+[]
+
+[Variables]
+  [valence]
+  []
+[]
+
+[Kernels]
+  [lumped_area]
+    type = BodyForce
+    variable = valence
+  []
+[]
+
+[NodalKernels]
+  [node_area]
+    # Area of a quarter element: the solution is the number of elements attached to each node
+    type = ReactionNodalKernel
+    variable = valence
+    coeff = 0.015625
+  []
+[]
+
+[Postprocessors]
+  [n_nodes]
+    type = NumNodes
+  []
+  [valence_l2]
+    type = NodalL2Norm
+    variable = valence
+  []
+[]
+
+[Preconditioning]
+  [lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
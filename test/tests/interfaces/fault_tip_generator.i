@@ -0,0 +1,81 @@
+# Fault ending inside the domain: only the two nodes below the tip are split
+# 25 nodes + 2 = 27 nodes
+# Sum of the squared number of elements per node: 196 without split, 196 - 4 + 2 x 1 - 16 + 2 x 4
+# = 186 with the split nodes below the tip
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+  []
+  [left]
+    type = SubdomainBoundingBoxGenerator
+    input = gen
+    block_id = 1
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+  []
+  [fault]
+    type = ParsedGenerateSideset
+    input = left
+    combinatorial_geometry = 'y < 0.5'
+    included_subdomains = 1
+    included_neighbors = 0
+    new_sideset_name = 'fault'
+  []
+  [interface_gen]
+    type = BVFaultInterfaceGenerator
+    input = fault
+    sidesets = 'fault'
+  []
+[]
+
+[Variables]
+  [valence]
+  []
+[]
+
+[Kernels]
+  [lumped_area]
+    type = BodyForce
+    variable = valence
+  []
+[]
+
+[NodalKernels]
+  [node_area]
+    # Area of a quarter element: the solution is the number of elements attached to each node
+    type = ReactionNodalKernel
+    variable = valence
+    coeff = 0.015625
+  []
+[]
+
+[Postprocessors]
+  [n_nodes]
+    type = NumNodes
+  []
+  [valence_l2]
+    type = NodalL2Norm
+    variable = valence
+  []
+[]
+
+[Preconditioning]
+  [lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
@@ -0,0 +1,205 @@
+# Drained column at rest under gravity: the fluid pressure is hydrostatic, p = rho_f * g * (1 - y),
+# the Darcy velocity vanishes and the effective vertical stress is lithostatic,
+# sigma'_yy = -(rho_b - b * rho_f) * g * (1 - y), whose average over the column is -1
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 10
+  xmin = -0.05
+  xmax = 0.05
+  ymin = 0
+  ymax = 1
+[]
+
+[Variables]
+  [pf]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [darcy]
+    type = BVSinglePhaseDarcy
+    variable = pf
+    gravity = '0 -1 0'
+  []
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+    fluid_pressure = pf
+    density = 3.0
+    gravity = '0 -1 0'
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+    fluid_pressure = pf
+    density = 3.0
+    gravity = '0 -1 0'
+  []
+[]
+
+[AuxVariables]
+  [vf_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [vf_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [vf_x_aux]
+    type = BVDarcyVelocityAux
+    variable = vf_x
+    component = x
+    fluid_pressure = pf
+    gravity = '0 -1 0'
+    execute_on = 'TIMESTEP_END'
+  []
+  [vf_y_aux]
+    type = BVDarcyVelocityAux
+    variable = vf_y
+    component = y
+    fluid_pressure = pf
+    gravity = '0 -1 0'
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[BCs]
+  [confine_x]
+    type = DirichletBC
+    variable = disp_x
+    value = 0
+    boundary = 'left right'
+  []
+  [base_fixed]
+    type = DirichletBC
+    variable = disp_y
+    value = 0
+    boundary = 'bottom'
+  []
+  [top_drained]
+    type = DirichletBC
+    variable = pf
+    value = 0
+    boundary = 'top'
+  []
+[]
+
+[Functions]
+  [pf_exact]
+    type = ParsedFunction
+    expression = '1 - y'
+  []
+[]
+
+[Materials]
+  [mechanical]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y'
+    bulk_modulus = 4
+    shear_modulus = 3
+  []
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [single_phase_poromech]
+    type = BVPoroMechanicsMaterial
+    biot_coefficient = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 0.1
+  []
+  [fluid]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+    thermal_expansion = 0.0
+    bulk_modulus = 1.0e+30
+  []
+[]
+
+[Postprocessors]
+  [pf_error]
+    type = ElementL2Error
+    variable = pf
+    function = pf_exact
+  []
+  [vf_x_max]
+    type = ElementExtremeValue
+    variable = vf_x
+    value_type = max_abs
+  []
+  [vf_y_max]
+    type = ElementExtremeValue
+    variable = vf_y
+    value_type = max_abs
+  []
+  [stress_yy]
+    type = ElementAverageValue
+    variable = stress_yy
+  []
+[]
+
+[Preconditioning]
+  [lu]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 1
+  dt = 1
+  nl_abs_tol = 1.0e-12
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  csv = true
+[]
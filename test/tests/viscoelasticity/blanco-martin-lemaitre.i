@@ -199,6 +199,20 @@ Q1 = 5.5
   []
 []
 
+[Postprocessors]
+  [max_its]
+    type = ElementExtremeMaterialProperty
+    mat_prop = return_map_iterations
+    value_type = max
+    outputs = csv
+  []
+  [avg_its]
+    type = ElementAverageMaterialProperty
+    mat_prop = return_map_iterations
+    outputs = csv
+  []
+[]
+
 [Preconditioning]
   active = 'hypre'
   [hypre]
@@ -254,4 +268,5 @@ Q1 = 5.5
 [Outputs]
   perf_graph = true
   exodus = true
+  csv = true
 []
\ No newline at end of file
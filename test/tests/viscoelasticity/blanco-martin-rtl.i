@@ -195,6 +195,30 @@ Q1 = 5.5
   []
 []
 
+[Postprocessors]
+  [strain_yy]
+    type = ElementAverageValue
+    variable = strain_yy
+    outputs = csv
+  []
+  [eqv_creep_strain_L]
+    type = ElementAverageValue
+    variable = eqv_creep_strain_L
+    outputs = csv
+  []
+  [max_its]
+    type = ElementExtremeMaterialProperty
+    mat_prop = return_map_iterations
+    value_type = max
+    outputs = csv
+  []
+  [avg_its]
+    type = ElementAverageMaterialProperty
+    mat_prop = return_map_iterations
+    outputs = csv
+  []
+[]
+
 [Preconditioning]
   active = 'hypre'
   [hypre]
@@ -250,4 +274,5 @@ Q1 = 5.5
 [Outputs]
   perf_graph = true
   exodus = true
+  csv = true
 []
\ No newline at end of file
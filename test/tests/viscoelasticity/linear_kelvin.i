@@ -122,6 +122,18 @@
   []
 []
 
+[Postprocessors]
+  [creep_rate]
+    type = BVMaxCreepRate
+    outputs = csv
+  []
+  [stress_yy]
+    type = ElementAverageValue
+    variable = stress_yy
+    outputs = csv
+  []
+[]
+
 [Preconditioning]
   [hypre]
     type = SMP
@@ -141,4 +153,5 @@
 
 [Outputs]
   exodus = true
+  csv = true
 []
@@ -120,6 +120,18 @@
   []
 []
 
+[Postprocessors]
+  [creep_rate]
+    type = BVMaxCreepRate
+    outputs = csv
+  []
+  [stress_yy]
+    type = ElementAverageValue
+    variable = stress_yy
+    outputs = csv
+  []
+[]
+
 [Preconditioning]
   [hypre]
     type = SMP
@@ -139,4 +151,5 @@
 
 [Outputs]
   exodus = true
+  csv = true
 []
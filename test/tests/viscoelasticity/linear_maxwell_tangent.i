@@ -0,0 +1,147 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 8
+  ny = 8
+  nz = 2
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  zmin = 0
+  zmax = 0.1
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergenceNonAD
+    displacements = 'disp_x disp_y disp_z'
+    component = x
+    variable = disp_x
+  []
+  [stress_y]
+    type = BVStressDivergenceNonAD
+    displacements = 'disp_x disp_y disp_z'
+    component = y
+    variable = disp_y
+  []
+  [stress_z]
+    type = BVStressDivergenceNonAD
+    displacements = 'disp_x disp_y disp_z'
+    component = z
+    variable = disp_z
+  []
+[]
+
+[AuxVariables]
+  [strain_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [strain_yy_aux]
+    type = BVStrainComponentAux
+    variable = strain_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left'
+    value = 0.0
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom'
+    value = 0.0
+  []
+  [no_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'front back'
+    value = 0.0
+  []
+  [v_x]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'right'
+    function = '-0.5*t'
+  []
+  [v_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 'top'
+    function = '0.5*t'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0
+    shear_modulus = 1.0
+    inelastic_models = 'viscoelastic'
+    compute_tangent = true
+  []
+  [viscoelastic]
+    type = BVMaxwellViscoelasticUpdate
+    viscosity = 1.0
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_hypre_type'
+    petsc_options_value = 'hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 1.0
+  dt = 0.1
+[]
+
+[Outputs]
+  file_base = linear_maxwell_out
+  exodus = true
+[]